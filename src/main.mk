@@ -180,6 +180,11 @@ SUBMAKEFILES := meryl/meryl.mk \
 
 ifeq ($(BUILDTESTS), 1)
 SUBMAKEFILES += tests/merylCountArrayTest.mk \
+                tests/merylCountArrayRadixTest.mk \
                 tests/merylExactLookupTest.mk \
+                tests/merylMergeTreeTest.mk \
+                tests/merylOpComputeTest.mk \
+                tests/merylSelectorProgramTest.mk \
+                tests/merylLookupBatchTest.mk \
                 tests/matchTokenTest.mk
 endif
@@ -3,7 +3,8 @@ SOURCES  := meryl-lookup.C \
             meryl-lookup-help.C \
             dump.C \
             existence.C \
-            include-exclude.C
+            include-exclude.C \
+            lookup-index.C
 
 SRC_INCDIRS := .
 
@@ -1,5 +1,6 @@
 TARGET   := position-lookup
 SOURCES  := position-lookup.C \
+            lookup-index.C
 
 SRC_INCDIRS := .
 
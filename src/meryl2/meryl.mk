@@ -11,6 +11,7 @@ SOURCES  := meryl.C \
             merylInput.C \
             merylInput-canu.C \
             merylSelector.C \
+            merylSelectorProgram.C \
             merylOp-count-memorySize.C \
             merylOp-count.C \
             merylOp-countSequential.C \
@@ -0,0 +1,8 @@
+TARGET   := merylLookupBatchTest
+SOURCES  := merylLookupBatchTest.C ../meryl-lookup/lookup-index.C
+
+SRC_INCDIRS  := . ../utility/src ../meryl-lookup
+
+TGT_LDFLAGS := -L${TARGET_DIR}/lib
+TGT_LDLIBS  := -l${MODULE}
+TGT_PREREQS := lib${MODULE}.a
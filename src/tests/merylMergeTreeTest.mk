@@ -0,0 +1,8 @@
+TARGET   := merylMergeTreeTest
+SOURCES  := merylMergeTreeTest.C
+
+SRC_INCDIRS  := . ../utility/src ../meryl2
+
+TGT_LDFLAGS := -L${TARGET_DIR}/lib
+TGT_LDLIBS  := -l${MODULE}
+TGT_PREREQS := lib${MODULE}.a
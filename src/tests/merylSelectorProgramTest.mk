@@ -0,0 +1,29 @@
+TARGET   := merylSelectorProgramTest
+SOURCES  := merylSelectorProgramTest.C \
+            ../meryl2/merylCommandBuilder-isAssign.C \
+            ../meryl2/merylCommandBuilder-isSelect.C \
+            ../meryl2/merylCommandBuilder-printTree.C \
+            ../meryl2/merylCommandBuilder-processText.C \
+            ../meryl2/merylCommandBuilder-spawnThreads.C \
+            ../meryl2/merylCommandBuilder.C \
+            ../meryl2/merylCountArray.C \
+            ../meryl2/merylGlobals.C \
+            ../meryl2/merylInput.C \
+            ../meryl2/merylInput-canu.C \
+            ../meryl2/merylSelector.C \
+            ../meryl2/merylSelectorProgram.C \
+            ../meryl2/merylOp-count-memorySize.C \
+            ../meryl2/merylOp-count.C \
+            ../meryl2/merylOp-countSequential.C \
+            ../meryl2/merylOp-countSimple.C \
+            ../meryl2/merylOp-countThreads.C \
+            ../meryl2/merylOp-nextMer.C \
+            ../meryl2/merylOp.C \
+            ../meryl2/merylOpCompute.C \
+            ../meryl2/merylOpTemplate.C
+
+SRC_INCDIRS  := . ../utility/src ../meryl2
+
+TGT_LDFLAGS := -L${TARGET_DIR}/lib
+TGT_LDLIBS  := -l${MODULE}
+TGT_PREREQS := lib${MODULE}.a